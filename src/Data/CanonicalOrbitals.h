@@ -39,6 +39,11 @@ namespace Data {
             QList<double> const& alphaEnergies, QList<double> const& betaCoefficients,  
             QList<double> const& betaEnergies, QString const& label);
 
+         CanonicalOrbitals(unsigned const nAlpha, unsigned const nBeta, 
+            ShellList const& shells, std::vector<double> const& alphaCoefficients, 
+            QList<double> const& alphaEnergies, std::vector<double> const& betaCoefficients,  
+            QList<double> const& betaEnergies, QString const& label);
+
          DensityList const& densityList() const { return m_densityList; }
          void appendDensities(Data::DensityList const& densities) {
             m_densityList << densities;
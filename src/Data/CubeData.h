@@ -36,6 +36,10 @@ namespace Data {
          CubeData(Geometry const& geometry, GridSize const& size, SurfaceType const& type, 
            QList<double> const& data) : GridData(size, type, data), m_geometry(geometry) { }
 
+         /// Leaves the data uninitialized, to be filled via data()
+         CubeData(Geometry const& geometry, GridSize const& size, SurfaceType const& type)
+           : GridData(size, type), m_geometry(geometry) { }
+
          CubeData() { }  // for boost::serialize;
 
          Geometry const& geometry() const { return m_geometry; }
@@ -29,6 +29,7 @@
 #include "Math/Vector.h"
 #include "Math/Cube.h"
 #include <vector>
+#include <mutex>
 
 
 namespace IQmol {
@@ -40,6 +41,9 @@ namespace Data {
    class GridData : public Base {
 
       public:
+         /// Edge length, in cubes, of the bricks used by the min/max index
+         static constexpr unsigned BrickSize = 8;
+
          Type::ID typeID() const { return Type::GridData; }
 
          GridData(GridSize const&, SurfaceType const&);
@@ -90,6 +94,10 @@ namespace Data {
             return m_data(i,j,k);
          }
 
+         /// Raw access to the values, with k varying fastest, for readers
+         /// that fill the grid in place.  
+         double* data() { return m_data.data(); }
+
 		 /// Performs a tri-linear interpolation of the grid data at each of 
 		 /// the 8 nearest grid points about (x,y,z). Returns 0 outside the 
          /// range of the grid
@@ -103,11 +111,24 @@ namespace Data {
          // computes this = a*this + b*B
          void combine(double const a, double const b, GridData const& B);
 
+         void getNumberOfBricks(unsigned& nbx, unsigned& nby, unsigned& nbz) const;
+
+		 /// Loads active with a flag for each brick, indexed (bi*nby + bj)*nbz
+		 /// + bk, indicating whether the values in the brick straddle the
+		 /// isovalue, and hence whether it may contain part of the isosurface.
+		 /// The min/max index is built on the first call and reused for
+         /// subsequent isovalues.  Note that it is not updated when the data
+         /// are modified through operator(), see invalidateBrickIndex().
+         void getActiveBricks(double const isovalue, std::vector<unsigned char>& active) const;
+
+         void invalidateBrickIndex();
+
          void dump() const;
 
       private:
          void copy(GridData const&);
          std::vector<std::pair<double,double>> sortData(bool const squareData);
+         void buildBrickIndex() const;
 
          SurfaceType m_surfaceType;
          qglviewer::Vec m_origin;
@@ -115,6 +136,11 @@ namespace Data {
          Cube m_data;
          Vector  m_percentToIsovaluePositive; 
          Vector  m_percentToIsovalueNegative; 
+
+         // Lazily built min/max values over each brick
+         mutable Cube m_brickMin;
+         mutable Cube m_brickMax;
+         mutable std::mutex m_brickMutex;
    };
 
 
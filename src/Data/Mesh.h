@@ -26,6 +26,7 @@
 #include "OpenMesh/Core/IO/Options.hh"
 #include "OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh"
 #include <QPair>
+#include <vector>
 #include "QGLViewer/vec.h"
 
 
@@ -78,6 +79,20 @@ namespace Data {
          Mesh& operator+=(Mesh const&);
          Mesh& operator=(Mesh const& that);
 
+		 /// Adds a flat indexed triangle list, with three floats for each
+		 /// vertex and normal.  If the mesh is empty the half-edge structure
+		 /// is not built until something requires it, so meshes that are only
+         /// ever rendered do not pay for the topology.
+         void addTriangles(std::vector<float>&& vertices, std::vector<float>&& normals,
+            std::vector<unsigned>&& indices);
+
+         /// Returns true if the mesh is currently held only as flat arrays
+         bool isFlat() const { return !m_flatIndices.empty(); }
+
+         std::vector<float> const& flatVertices() const { return m_flatVertices; }
+         std::vector<float> const& flatNormals() const { return m_flatNormals; }
+         std::vector<unsigned> const& flatIndices() const { return m_flatIndices; }
+
          Vertex addVertex(OMMesh::Point const p);
          Vertex addVertex(double const x, double const y, double const z);
          Face   addFace(Vertex const& v0, Vertex const& v1, Vertex const& v2);
@@ -92,15 +107,15 @@ namespace Data {
          Normal const& normal(Vertex const& vertex) const;
 
          // Iterator convenience functions
-         OMMesh::VertexIter vbegin() { return m_omMesh.vertices_begin(); }
-         OMMesh::VertexIter vend()   { return m_omMesh.vertices_end(); }
-         OMMesh::ConstVertexIter vbegin() const { return m_omMesh.vertices_begin(); }
-         OMMesh::ConstVertexIter vend()   const { return m_omMesh.vertices_end(); }
+         OMMesh::VertexIter vbegin() { buildHalfEdge(); return m_omMesh.vertices_begin(); }
+         OMMesh::VertexIter vend()   { buildHalfEdge(); return m_omMesh.vertices_end(); }
+         OMMesh::ConstVertexIter vbegin() const { buildHalfEdge(); return m_omMesh.vertices_begin(); }
+         OMMesh::ConstVertexIter vend()   const { buildHalfEdge(); return m_omMesh.vertices_end(); }
 
-         OMMesh::FaceIter fbegin() { return m_omMesh.faces_begin(); }
-         OMMesh::FaceIter fend()   { return m_omMesh.faces_end(); }
-         OMMesh::ConstFaceIter fbegin() const { return m_omMesh.faces_begin(); }
-         OMMesh::ConstFaceIter fend()   const { return m_omMesh.faces_end(); }
+         OMMesh::FaceIter fbegin() { buildHalfEdge(); return m_omMesh.faces_begin(); }
+         OMMesh::FaceIter fend()   { buildHalfEdge(); return m_omMesh.faces_end(); }
+         OMMesh::ConstFaceIter fbegin() const { buildHalfEdge(); return m_omMesh.faces_begin(); }
+         OMMesh::ConstFaceIter fend()   const { buildHalfEdge(); return m_omMesh.faces_end(); }
 
          bool hasProperty(Property const property) const;
          bool requestProperty(Property const property);
@@ -139,8 +154,8 @@ namespace Data {
 
          bool computeVertexNormals();
 
-         OMMesh const& data() const { return m_omMesh; } 
-         OMMesh& data() { return m_omMesh; } 
+         OMMesh const& data() const { buildHalfEdge(); return m_omMesh; } 
+         OMMesh& data() { buildHalfEdge(); return m_omMesh; } 
 
 
       private:
@@ -158,6 +173,12 @@ namespace Data {
 
          void copy(Mesh const& that);
 
+         /// Converts the flat arrays, if any, into the half-edge structure
+         void buildHalfEdge() const { if (isFlat()) convertFlatArrays(); }
+         void convertFlatArrays() const;
+         void appendTriangles(std::vector<float> const& vertices, 
+            std::vector<float> const& normals, std::vector<unsigned> const& indices);
+
          // This requests the properties that every mesh must have, all the time
          void requestDefaultProperties();
 
@@ -182,6 +203,11 @@ namespace Data {
          /// This is the key data structure holding the Mesh information.
          OMMesh m_omMesh;
 
+         /// Flat triangle data, only used until the half-edge structure is built
+         std::vector<float>    m_flatVertices;
+         std::vector<float>    m_flatNormals;
+         std::vector<unsigned> m_flatIndices;
+
          /// Property handle for the face centroids used for plotting face normals
          OpenMesh::FPropHandleT<OMMesh::Point>  m_faceCentroidsHandle;
 
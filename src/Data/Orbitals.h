@@ -24,6 +24,7 @@
 #include "Data/Data.h"
 #include "Data/ShellList.h"
 #include "Math/Matrix.h"
+#include <vector>
 
 
 namespace IQmol {
@@ -56,6 +57,14 @@ namespace Data {
             QList<double> const& betaCoefficients,
             QString const& title = QString());
 
+         // As above, for coefficients read straight into a vector
+         Orbitals(
+            OrbitalType const orbitalType, 
+            ShellList const& shellList,
+            std::vector<double> const& alphaCoefficients, 
+            std::vector<double> const& betaCoefficients,
+            QString const& title = QString());
+
          OrbitalType orbitalType() const { return m_orbitalType; }
 
          unsigned nBasis() const { return m_nBasis; }
@@ -94,6 +103,11 @@ namespace Data {
 
 
       protected:
+         // Fills the coefficient matrices from the flat lists, of either type,
+         // that are passed to the constructors.
+         template <class List>
+         void setCoefficients(List const& alphaCoefficients, List const& betaCoefficients);
+
          // Reorders the coefficients from QChem to FChk order.  
          void reorderFromQChem(Matrix&);
          bool areOrthonormal() const;
@@ -71,6 +71,13 @@ namespace Data {
 
          unsigned nBasis() const { return nFunctions(m_angularMomentum); }
 
+         qglviewer::Vec const& position() const { return m_position; }
+
+         QList<double> const& exponents() const { return m_exponents; }
+         QList<double> const& contractionCoefficients() const { 
+            return m_contractionCoefficients; 
+         }
+
 		 /// Returns the (-1,-1,-1) and (1,1,1) octant corners of a rectangular
 		 /// box that encloses the significant region of the Shell where 
 		 /// significance is determined by thresh.  Note that for surfaces this 
@@ -81,12 +88,30 @@ namespace Data {
          void boundingBox(qglviewer::Vec& min, qglviewer::Vec& max, 
             double const thresh = 0.001);
 
+         /// Returns true if the significant region of the Shell, as set by the
+         /// last call to boundingBox(), overlaps the axis-aligned box with the
+         /// given corners.
+         bool overlapsBox(qglviewer::Vec const& min, qglviewer::Vec const& max) const;
+
+         /// The square of the significant radius set by the last call to 
+         /// boundingBox(), or the largest double if it has not been called.
+         double significantRadiusSquared() const { return m_significantRadiusSquared; }
+
          /// Thread-safe evaluation path.  Returns false when the point is
          /// outside the shell's significant radius, otherwise fills the
          /// caller-provided buffer with the basis values in Molden order.
          bool evaluate(double const x, double const y, double const z,
             std::vector<double>& values) const;
 
+         /// Block evaluation path for a batch of nPoints points given in
+         /// structure-of-arrays form (e.g. a z-row of a grid).  The basis
+         /// values are written to values[f*stride + p] for function f and
+         /// point p, with points beyond the significant radius set to zero.
+         /// Returns false, leaving values untouched, if none of the points
+         /// lie within the significant radius.
+         bool evaluate(unsigned const nPoints, double const* x, double const* y,
+            double const* z, double* values, unsigned const stride) const;
+
 		 // Legacy evaluation path that uses internal scratch storage and
          // returns a null pointer when the point is beyond the significant
          // radius.  Keep this for existing serial callers during the staged
@@ -111,6 +136,14 @@ namespace Data {
 
          void normalizeToAngstrom();
 
+         /// Number of points processed together by the block evaluate(),
+         /// chosen so the scratch arrays stay in L1 cache.
+         static constexpr unsigned BlockSize = 64;
+
+         /// Evaluates at most BlockSize points for the block evaluate().
+         void evaluateBlock(unsigned const nPoints, double const* x, double const* y,
+            double const* z, double* values, unsigned const stride) const;
+
          AngularMomentum m_angularMomentum;
          unsigned        m_nFunctions;
          unsigned        m_atomIndex;
@@ -0,0 +1,73 @@
+#ifndef IQMOL_DATA_SHELLINDEX_H
+#define IQMOL_DATA_SHELLINDEX_H
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "QGLViewer/vec.h"
+#include <vector>
+
+
+namespace IQmol {
+namespace Data {
+
+   class ShellList;
+
+   /// Finds the Shells whose significant region reaches a box without 
+   /// testing every Shell.  The Shells are bucketed on a uniform grid of
+   /// cells no smaller than the largest significant radius, so each Shell
+   /// is listed in at most 27 cells and a query only visits the cells the
+   /// box overlaps.  The index reflects the significant radii at the time it
+   /// is built, as set by ShellList::boundingBox(), so it should be built
+   /// once per grid evaluation.  Shells with no significant radius set are
+   /// returned for every box.
+   class ShellIndex {
+
+      public:
+         ShellIndex(ShellList const&);
+
+         /// Fills shells with the indices, in increasing order, of the
+         /// Shells whose significant region overlaps the box with the given
+         /// corners.
+         void significantShells(qglviewer::Vec const& min, qglviewer::Vec const& max,
+            std::vector<unsigned>& shells) const;
+
+         /// As above, for the bounding box of a batch of n points given in
+         /// structure-of-arrays form.
+         void significantShells(unsigned const n, double const* x, double const* y,
+            double const* z, std::vector<unsigned>& shells) const;
+
+      private:
+         ShellList const& m_shellList;
+         qglviewer::Vec m_origin;
+         double m_cellSize;
+         int m_nCells[3];
+
+         // Shells in cell c are m_entries[m_cellStart[c]] to 
+         // m_entries[m_cellStart[c+1]-1], in increasing order.
+         std::vector<unsigned> m_cellStart;
+         std::vector<unsigned> m_entries;
+         std::vector<unsigned> m_unbounded;
+   };
+
+} } // end namespace IQmol::Data
+
+#endif
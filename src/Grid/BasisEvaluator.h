@@ -25,6 +25,8 @@
 #include "Math/Function.h"
 #include "Math/Matrix.h"
 #include "Data/GridData.h"
+#include "Data/ShellIndex.h"
+#include <vector>
 
 
 namespace IQmol {
@@ -48,6 +50,10 @@ namespace IQmol {
 
          ~BasisEvaluator();
 
+         /// Uses adaptive refinement with the given error bound in place of
+         /// the fixed coarse graining, see GridEvaluator.
+         void setAdaptiveRefinement(double const errorBound);
+
       Q_SIGNALS:
          void progress(int);
 
@@ -58,14 +64,27 @@ namespace IQmol {
 		 // Fills the m_returnValues vector with the value of each requested
 		 // orbital at the given point.
          void functionValues(double const x, double const y, double const z, Vector& values);
+         void functionBlockValues(unsigned const n, double const* x, double const* y, 
+            double const* z, Matrix& values);
 
          MultiFunction3D    m_function;
+         BlockFunction3D    m_blockFunction;
          Data::GridDataList m_grids;
          Data::ShellList&   m_shellList;
+         Data::ShellIndex   m_shellIndex;
          QList<int>         m_indices;
          GridEvaluator*     m_evaluator;
          QList<unsigned>    m_shellIndices;
+         std::vector<bool>  m_requiredShells;
          QList<unsigned>    m_shellOffsets;
+
+         // Per-thread working space for functionBlockValues(), as for the
+         // DensityEvaluator.
+         struct Scratch {
+            std::vector<unsigned> shells;
+            std::vector<double> shellValues;
+         };
+         std::vector<Scratch> m_scratch;
    };
 
 } // end namespace IQmol
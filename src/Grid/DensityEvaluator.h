@@ -23,6 +23,7 @@
 
 #include "Util/Task.h"
 #include "Data/GridData.h"
+#include "Data/ShellIndex.h"
 #include "Math/Function.h"
 #include "Math/Matrix.h"
 #include <vector>
@@ -49,6 +50,10 @@ namespace IQmol {
 
          ~DensityEvaluator();
 
+         /// Uses adaptive refinement with the given error bound in place of
+         /// the fixed coarse graining, see GridEvaluator.
+         void setAdaptiveRefinement(double const errorBound);
+
       Q_SIGNALS:
          void progress(int);
 
@@ -60,14 +65,31 @@ namespace IQmol {
 
       private:
          void densityValues(double const x, double const y, double const z, Vector& values);
+         void densityBlockValues(unsigned const n, double const* x, double const* y, 
+            double const* z, Matrix& values);
 
          MultiFunction3D      m_function;
+         BlockFunction3D      m_blockFunction;
          Data::GridDataList   m_grids;
          Data::ShellList&     m_shellList;
+         Data::ShellIndex     m_shellIndex;
          QList<Vector const*> m_densities;
          std::vector<Data::Shell const*> m_shells;
          std::vector<unsigned> m_shellOffsets;
          std::vector<double const*> m_densityData;
+
+         // Working space for densityBlockValues(), which the GridEvaluator
+         // calls from several threads at once.  There is one per thread and
+         // the buffers are only ever grown, so after the first few boxes
+         // nothing is allocated.
+         struct Scratch {
+            std::vector<unsigned> shells;
+            std::vector<unsigned> sigBasis;
+            std::vector<double> basisValues;
+            std::vector<double> W;
+            std::vector<double> T;
+         };
+         std::vector<Scratch> m_scratch;
          GridEvaluator*       m_evaluator;
          unsigned             m_nBasis;
    };
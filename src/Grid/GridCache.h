@@ -0,0 +1,100 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QCryptographicHash>
+#include <QStringList>
+#include <QMutex>
+
+class QThreadPool;
+
+
+namespace IQmol {
+
+namespace Data {
+   class GridData;
+   class GridSize;
+   class ShellList;
+   class SurfaceType;
+}
+
+   /// Persistent cache of computed grids, so that a surface requested again,
+   /// for example after reopening a checkpoint file, does not have to be
+   /// recomputed.  Grids are content-addressed: the key is a hash of every
+   /// input that determines the grid values and each grid is stored in the
+   /// binary grid format in a file named after its key.  The cache is kept 
+   /// below Preferences::GridCacheSize() by deleting the least recently used
+   /// files.  Files that fail to read, or whose grid does not match the
+   /// request, are deleted and treated as a miss.  Writes are done on a 
+   /// background thread, one batch at a time, and each entry is published by
+   /// renaming a complete file so load() never waits on a write.
+   class GridCache {
+
+      public:
+         /// Accumulates the inputs of a grid into a cache key.
+         class Key {
+            public:
+               Key();
+               void add(Data::ShellList const&);
+               void add(Data::GridSize const&);
+               void add(Data::SurfaceType const&);
+               void add(double const* values, size_t const n);
+               void add(QString const&);
+
+               /// Returns the key as a hex string, no further data 
+               /// should be added once this has been called.
+               QString toString();
+
+            private:
+               void add(char const* data, size_t const n);
+               QCryptographicHash m_hash;
+         };
+
+         /// Returns a new grid read from the cache, or 0 if there is no 
+         /// valid entry for the key or the cache is disabled.
+         static Data::GridData* load(QString const& key, Data::SurfaceType const&,
+            Data::GridSize const&);
+
+         /// Queues copies of the grids to be written to the cache under the
+         /// corresponding keys, after which old entries are evicted as 
+         /// required.  Grids with an empty key are skipped and the caller 
+         /// retains ownership of the grids.
+         static void store(QStringList const& keys, QList<Data::GridData*> const&);
+         static void store(QString const& key, Data::GridData*);
+
+         /// Blocks until all the queued writes have completed.
+         static void waitForDone();
+
+         static bool enabled();
+         static void clear();
+         static QString directory();
+
+      private:
+         class Writer;
+         static QString filePath(QString const& key);
+         static bool write(QString const& path, Data::GridData*);
+         static void prune(QString const& directory, qint64 const limit);
+         static QThreadPool& pool();
+         static QMutex s_mutex;
+   };
+
+} // end namespace IQmol
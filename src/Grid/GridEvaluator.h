@@ -23,6 +23,8 @@
 
 #include "Util/Task.h"
 #include "Math/Function.h"
+#include "Math/Cube.h"
+#include <vector>
 
 
 namespace IQmol {
@@ -43,7 +45,8 @@ namespace IQmol {
          // grids and the return on the MultiFunction3D object.
          GridEvaluator(QList<Data::GridData*> grids, MultiFunction3D const& function,
             double const thresh = 0.001, bool const coarseGrain = true)
-          : m_grids(grids),  m_function(function), m_thresh(thresh), m_coarseGrain(coarseGrain)
+          : m_grids(grids),  m_function(function), m_thresh(thresh), m_coarseGrain(coarseGrain),
+            m_errorBound(0.0)
          {
             checkGrids();
          }
@@ -51,25 +54,98 @@ namespace IQmol {
          // For when we have a only a single grid
          GridEvaluator(Data::GridData* grid, MultiFunction3D const& function,
             double const thresh = 0.001, bool const coarseGrain = true)
-          : m_function(function), m_thresh(thresh), m_coarseGrain(coarseGrain)
+          : m_function(function), m_thresh(thresh), m_coarseGrain(coarseGrain),
+            m_errorBound(0.0)
          {
             m_grids.append(grid);
             checkGrids();
          }
 
+         // Optional block form of the function.  When set, the grid is
+         // evaluated a sub-box at a time rather than point by point.
+         void setBlockFunction(BlockFunction3D const& blockFunction) 
+         {
+            m_blockFunction = blockFunction;
+         }
+
+         // Replaces the fixed two-level coarse graining with adaptive
+         // refinement.  Cells are subdivided where any sampled value is above
+         // the coarse-graining screen, or where trilinear interpolation at the
+         // cell midpoints is in error by more than errorBound.  Other cells
+         // are filled by interpolation.  A non-positive bound reverts to 
+         // coarse graining.
+         void setAdaptiveRefinement(double const errorBound) 
+         {
+            m_errorBound = errorBound;
+         }
+
       protected:
          void run();
 
       private:
+         // The grid is evaluated in sub-boxes of at most BoxSize points along
+         // each edge.  The block function is handed all the points of a box at
+         // once, so any shell screening it does is carried out once per box.
+         static constexpr unsigned BoxSize = 8;
+
+         // Edge length, in grid points, of the cells used to seed the
+         // adaptive refinement.
+         static constexpr unsigned AdaptiveCellSize = 8;
+
+         // A cell of the adaptive refinement, given by its corner indices
+         struct Cell {
+            unsigned i0, i1, j0, j1, k0, k1;
+         };
+
+         // Per-thread scratch space for the box and refinement passes
+         struct Scratch {
+            std::vector<double> x, y, z;
+            std::vector<unsigned> cells;
+            Matrix values;
+            Vector point;
+         };
+
          void checkGrids();
          void runCoarseGrain();
          void evaluateAndStore(double x, double y, double z, unsigned i, unsigned j,
             unsigned k, Vector& values);
 
+         // Evaluates the points of the sub-box with corner (i0, j0, k0) using
+         // every step'th point along each edge, and stores the results.
+         void evaluateBoxAndStore(unsigned const i0, unsigned const j0, 
+            unsigned const k0, unsigned const step, Scratch& buffer);
+
+         // Evaluates all the sub-boxes in the slab starting at x-index i0.
+         void evaluateSlab(unsigned const i0, unsigned const step);
+
+         // Refinement pass of the coarse-grained evaluation for the octants
+         // with x-index i.  Safe to call concurrently for different i.
+         void refineSlice(unsigned const i, Cube const& screen, Scratch& scratch);
+
+         void runAdaptive();
+
+         // Evaluates the given points exactly, in parallel batches
+         void evaluatePoints(std::vector<Cube::Index>& points);
+
+         // Returns the corner and midpoint indices of the cell along each
+         // dimension.  Midpoints are only included for edges with interior points.
+         static void bisect(Cell const& cell, std::vector<unsigned>& is,
+            std::vector<unsigned>& js, std::vector<unsigned>& ks);
+
+         // Decides whether the cell needs subdividing, based on the exact
+         // values at its corners and bisection points.
+         bool needsRefinement(Cell const& cell) const;
+
+         // Fills the points owned by the cell that have not been computed
+         // exactly using trilinear interpolation from the corners.
+         void interpolateCell(Cell const& cell, std::vector<unsigned char> const& computed);
+
          QList<Data::GridData*> m_grids;
          MultiFunction3D const& m_function;
+         BlockFunction3D m_blockFunction;
          double m_thresh;
          bool m_coarseGrain;
+         double m_errorBound;
    };
 
 } // end namespace IQmol
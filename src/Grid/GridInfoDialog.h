@@ -35,9 +35,9 @@ namespace IQmol {
 
       public:
 		 // We pass the molecule name and coordinates so that 
-		 // we can export a cube file if requested.
+		 // we can export a cube or grid file if requested.
          GridInfoDialog(Data::GridDataList*, QString const& moleculeName,
-            QStringList const& coordinates);
+            QStringList const& coordinates, Data::Geometry const&);
 
       Q_SIGNALS:
          void updated();  // to trigger a redraw
@@ -47,12 +47,17 @@ namespace IQmol {
          void deleteGrid();
          void exportCubeFilePositive() { exportCubeFile(false); }
          void exportCubeFileNegative() { exportCubeFile(true); }
+         void exportGridFileDouble() { exportGridFile(false); }
+         void exportGridFileSingle() { exportGridFile(true); }
 
       private:
          void exportCubeFile(bool const invertSign);
+         void exportGridFile(bool const singlePrecision);
+        QString uniqueFileName(Data::GridData const&, QString const& extension);
         Data::GridDataList* m_gridDataList;
         QString m_moleculeName;
         QStringList m_coordinates;
+        Data::Geometry m_geometry;
         Data::GridDataList getSelectedGrids();
         Ui::GridInfoDialog m_dialog;
         void loadGridInfo();
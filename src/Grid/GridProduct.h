@@ -32,13 +32,26 @@ namespace IQmol {
       class GridData;
    }
 
+   /// Computes the radial decay of the first order density matrix 
+   ///   P(r1,r2) = sum_i f_i(r1) f_i(r2)
+   /// where the f_i are the given grids.  On return, values(b) holds either
+   /// the maximum of |P| (the default) or the root mean square of P over all
+   /// pairs of grid points with |r1-r2| in bin b.
+   ///
+   /// The maximum requires the O(N^2) loop over pairs of points.  The root
+   /// mean square is obtained from the power spectra of the products f_i f_j
+   /// in O(N log N) work for each pair of grids, unless the zero padded
+   /// transforms would exceed the grid memory limit, in which case the pair
+   /// loop is used instead.
    class GridProduct: public Task {
 
       Q_OBJECT
 
       public:
+         enum Statistic { Maximum, RootMeanSquare };
+
          GridProduct(Vector& values, QList<Data::GridData const*>&  grids, 
-            double const binSize = 0.1);
+            double const binSize = 0.1, Statistic const statistic = Maximum);
 
       Q_SIGNALS:
          void progressValue(int);
@@ -47,9 +60,15 @@ namespace IQmol {
          void run();
 
       private:
+         void runFft();
+         void runExact();
+         bool fftFits() const;
+
          Vector& m_values;
          QList<Data::GridData const*> m_grids;
          double  m_binSize;
+         Statistic m_statistic;
+         bool      m_useFft;
    };
 
 } // end namespace IQmol
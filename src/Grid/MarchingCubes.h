@@ -24,7 +24,7 @@
 
 #include "Data/Mesh.h"
 #include "QGLViewer/vec.h"
-#include <QMap>
+#include <vector>
 
 
 namespace IQmol {
@@ -43,79 +43,59 @@ namespace Data {
 
       Q_OBJECT
 
-      private:
-         // Utility class to allow for the creation of a vertex map
-         class Index {
-            public:
-               Index(unsigned const i = 0, unsigned const j = 0, unsigned const k = 0, 
-                  unsigned const direction = 0) : m_i(i), m_j(j), m_k(k), m_w(direction) { }
-
-               Index(Index const& that) { copy(that); }
-
-               Index& operator=(Index const& that) 
-               {
-                   if (this != &that) copy(that);
-                   return *this;
-               }
-
-               bool operator<(Index const& that) const
-               {
-                  if (m_i < that.m_i) return true;
-                  if (m_i > that.m_i) return false;
-
-                  if (m_j < that.m_j) return true;
-                  if (m_j > that.m_j) return false;
-
-                  if (m_k < that.m_k) return true;
-                  if (m_k > that.m_k) return false;
-
-                  return (m_w < that.m_w);
-               }
-
-               QString toString() const 
-               {
-                  QString s("(");
-                  s += QString::number(m_i);
-                  s += ",";
-                  s += QString::number(m_j);
-                  s += ",";
-                  s += QString::number(m_k);
-                  if (m_w == 0) s += " / x)";
-                  if (m_w == 1) s += " / y)";
-                  if (m_w == 2) s += " / z)";
-                  return s;
-               }
-
-            private:
-               unsigned m_i, m_j, m_k, m_w;
-
-               void copy(Index const& that) 
-               {
-                  m_i = that.m_i;  m_j = that.m_j;  m_k = that.m_k;  m_w = that.m_w;
-               }
-         };
-
+      friend class SlabMarchingCubes;
 
       public:
          MarchingCubes(Data::GridData const& grid);
          void generateMesh(double const isovalue, Data::Mesh&);
 
+		 /// Generates the isosurface as flat arrays, with three floats for
+		 /// each vertex and normal and three indices for each triangle.  The
+         /// normals are taken from the gradient of the grid.
+         void generateTriangles(double const isovalue, std::vector<float>& vertices,
+            std::vector<float>& normals, std::vector<unsigned>& indices);
+
 
       Q_SIGNALS:
          void progress(double);  // 0.0-1.0
 
 
       private:
+		 /// The grid is divided into slabs of cubes along the x-axis which are
+		 /// processed independently.  Edge vertices are found through two
+		 /// rolling planes of indices, for the y- and z-edges on the lower and
+		 /// upper faces of the current layer of cubes, and an array for the
+		 /// x-edges within the layer.  Vertex indices are local to the slab.
+		 /// Only the bricks of the grid that straddle the isovalue are visited
+		 /// and the entries that were set are recorded so the planes can be
+         /// reset without touching the whole array.
+         struct Slab {
+            unsigned begin, end;    // range of cube x-indices
+            std::vector<qglviewer::Vec> vertices;
+            std::vector<qglviewer::Vec> normals;
+            std::vector<unsigned> triangles;
+
+            std::vector<int> lower, upper, xEdges;
+            std::vector<size_t> lowerSet, upperSet, xEdgesSet;
+
+            // Copies of the edge-vertex planes at the slab boundaries, used to
+            // stitch neighbouring slabs together.
+            std::vector<int> firstPlane, lastPlane;
+         };
+
+         void marchSlab(Slab& slab, std::vector<unsigned char> const& activeBricks);
+
          /// Performs the Marching Cubes algorithm on a single cube.
-         void marchOnCube(int const ix, int const iy, int const iz);
+         void marchOnCube(int const ix, int const iy, int const iz, Slab& slab);
 
 		 /// Finds the approximate point of intersection of the surface between
 		 /// two points with the values v1 and v2.
-         double getOffset(double const v1, double const v2);
+         double getOffset(double const v1, double const v2) const;
 
-         /// Adds a new vertex to the mesh
-         Data::OMMesh::VertexHandle createEdgeVertex(unsigned const edge, double const offset, 
-            qglviewer::Vec const& origin);
+         /// Adds a new vertex to the slab for the edge from grid point 
+         /// (ix,iy,iz) along the given axis, returning its local index.
+         int createEdgeVertex(unsigned const ix, unsigned const iy, unsigned const iz,
+            unsigned const axis, double const offset, Slab& slab) const;
 
          // Static Data
          static const double   s_vertexOffset[8][3];
@@ -126,14 +106,11 @@ namespace Data {
          static const int      s_cubeEdgeFlags[256];
          static const int      s_triangleConnectionTable[256][16];
 
-         Data::Mesh*           m_mesh;
          Data::GridData const& m_grid;
          qglviewer::Vec const& m_origin;
          qglviewer::Vec const& m_delta;
          unsigned m_nx, m_ny, m_nz;
          double   m_isovalue;
-
-         QMap<Index, Data::OMMesh::VertexHandle> m_vertexMap;
    };
 
 } // end namespace IQmol
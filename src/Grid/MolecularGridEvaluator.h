@@ -47,6 +47,10 @@ namespace IQmol {
 
          Data::GridDataList const& getGrids() const { return m_grids; }
 
+         /// Error bound for the adaptive refinement of the orbital, density
+         /// and basis function grids, a value <= 0 disables it.
+         void setAdaptiveRefinement(double const errorBound) { m_errorBound = errorBound; }
+
       Q_SIGNALS:
          void progressLabelText(QString const& label);
          void progressMaximum(int max);
@@ -67,6 +71,7 @@ namespace IQmol {
 
          Matrix const&      m_alphaImaginaryCoefficients;
          Matrix const&      m_betaImaginaryCoefficients;
+         double             m_errorBound;
    };
 
 } // end namespace IQmol
@@ -23,6 +23,7 @@
 
 #include "Util/Task.h"
 #include "Data/GridData.h"
+#include "Data/ShellIndex.h"
 #include "Math/Function.h"
 #include "Math/Matrix.h"
 #include <vector>
@@ -51,6 +52,10 @@ namespace IQmol {
 
          ~OrbitalEvaluator();
 
+         /// Uses adaptive refinement with the given error bound in place of
+         /// the fixed coarse graining, see GridEvaluator.
+         void setAdaptiveRefinement(double const errorBound);
+
       Q_SIGNALS:
          void progress(int);
 
@@ -59,15 +64,27 @@ namespace IQmol {
 
       private:
          void orbitalValues(double const x, double const y, double const z, Vector& values);
+         void orbitalBlockValues(unsigned const n, double const* x, double const* y, 
+            double const* z, Matrix& values);
 
          MultiFunction3D         m_function;
+         BlockFunction3D         m_blockFunction;
          Data::GridDataList      m_grids;
          Data::ShellList const&  m_shellList;
+         Data::ShellIndex        m_shellIndex;
          Matrix const&           m_coefficients;
          QList<int>              m_indices;
          std::vector<Data::Shell const*> m_shells;
          std::vector<unsigned>   m_shellOffsets;
          std::vector<double const*> m_coefficientRows;
+
+         // Per-thread working space for orbitalBlockValues(), as for the
+         // DensityEvaluator.
+         struct Scratch {
+            std::vector<unsigned> shells;
+            std::vector<double> shellValues;
+         };
+         std::vector<Scratch> m_scratch;
          GridEvaluator*          m_evaluator;
    };
 
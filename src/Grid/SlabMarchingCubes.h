@@ -0,0 +1,94 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Data/GridSize.h"
+#include "Data/Mesh.h"
+#include <QList>
+#include <QObject>
+#include <functional>
+#include <vector>
+
+
+namespace IQmol {
+
+   /// Marching cubes for grids that are too large to hold in memory.  The
+   /// grid is read one x-plane at a time through the PlaneReader and only a
+   /// window of four planes is kept, which is what is needed for one layer
+   /// of cubes and the central-difference normals at its vertices.  Several
+   /// isovalues are extracted in the same pass, so the file is read only
+   /// once.  The results match those of MarchingCubes for an in-memory grid.
+   class SlabMarchingCubes : public QObject {
+
+      Q_OBJECT
+
+      public:
+         /// Fills the given array with the next plane of ny*nz values, with z
+         /// varying fastest.  Returns false if the plane could not be read.
+         typedef std::function<bool(double*)> PlaneReader;
+
+         SlabMarchingCubes(Data::GridSize const& size, PlaneReader const& reader);
+
+         /// Generates the isosurface for each isovalue into the corresponding
+         /// mesh.  Returns false if a plane could not be read, in which case
+         /// the meshes are left empty.
+         bool generateMeshes(QList<double> const& isovalues, QList<Data::Mesh*> const& meshes);
+
+      Q_SIGNALS:
+         void progress(double);  // 0.0-1.0
+
+      private:
+         /// The output and rolling edge-vertex planes for one isovalue, laid
+         /// out as for MarchingCubes::Slab.  Vertices are added to the final
+         /// arrays as they are found, so no stitching is required.
+         struct Surface {
+            double isovalue;
+            std::vector<float> vertices;
+            std::vector<float> normals;
+            std::vector<unsigned> indices;
+
+            std::vector<int> lower, upper, xEdges;
+            std::vector<size_t> lowerSet, upperSet, xEdgesSet;
+         };
+
+         double value(unsigned const i, unsigned const j, unsigned const k) const
+         {
+            return m_window[i % WindowSize][size_t(j)*m_nz + k];
+         }
+
+         bool readPlanes(unsigned const last);
+         void marchLayer(unsigned const i, Surface&);
+         void marchOnCube(unsigned const ix, unsigned const iy, unsigned const iz, Surface&);
+         qglviewer::Vec gradient(unsigned const i, unsigned const j, unsigned const k) const;
+         int createEdgeVertex(unsigned const ix, unsigned const iy, unsigned const iz,
+            unsigned const axis, double const offset, Surface&) const;
+
+         static const unsigned WindowSize = 4;
+
+         Data::GridSize m_size;
+         PlaneReader m_reader;
+         unsigned m_nx, m_ny, m_nz;
+         unsigned m_planesRead;
+         std::vector<double> m_window[WindowSize];
+   };
+
+} // end namespace IQmol
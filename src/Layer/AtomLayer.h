@@ -25,7 +25,6 @@
 #include <QMap>
 
 
-class QFontMetrics;
 class QColor;
 
 namespace OpenBabel {
@@ -34,8 +33,9 @@ namespace OpenBabel {
 
 namespace IQmol {
 
-class Viewer;
 class PovRayGen;
+class ImpostorRenderer;
+class LevelOfDetail;
 
 namespace Layer {
 
@@ -48,6 +48,8 @@ namespace Layer {
       friend class Molecule;
       friend class Bond;
       friend class Constraint;
+      friend class IQmol::ImpostorRenderer;
+      friend class IQmol::LevelOfDetail;
 
       public:
 
@@ -71,6 +73,7 @@ namespace Layer {
          }
          static void setVibrationAmplitude(GLfloat const& amplitude) {
             s_vibrationAmplitude  = amplitude; 
+            geometryChanged();
          }
          static void setDisplayVibrationVector(bool const tf) {
             s_vibrationDisplayVector= tf; 
@@ -80,11 +83,10 @@ namespace Layer {
          void drawFast();
          void drawFlat();
          void drawSelected();
-         void drawLabel(Viewer& viewer, LabelType const, QFontMetrics&);
          void povray(PovRayGen&);
 
          void setAtomicNumber(unsigned int const Z);
-         void setSmallerHydrogens(bool const tf) { m_smallerHydrogens = tf; }
+         void setSmallerHydrogens(bool const tf) { m_smallerHydrogens = tf; geometryChanged(); }
          void setHideHydrogens(bool const tf) { m_hideHydrogens = tf; }
          void setCharge(double const charge) {m_charge = charge; }
          void setSpinDensity(double const spin) {m_spin = spin; }
@@ -123,6 +125,7 @@ namespace Layer {
       public Q_SLOTS:
          void setDisplacement(qglviewer::Vec const& displacement) { 
             m_displacement = displacement; 
+            geometryChanged();
          }
 
       protected:
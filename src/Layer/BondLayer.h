@@ -28,6 +28,8 @@
 namespace IQmol {
 
 class PovRayGen;
+class ImpostorRenderer;
+class LevelOfDetail;
 
 namespace Layer {
 
@@ -39,6 +41,8 @@ namespace Layer {
       Q_OBJECT
 
       friend class Molecule;
+      friend class IQmol::ImpostorRenderer;
+      friend class IQmol::LevelOfDetail;
 
       public:
          Bond(Atom* begin, Atom* end);
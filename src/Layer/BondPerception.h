@@ -0,0 +1,56 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <vector>
+#include <utility>
+
+
+namespace IQmol {
+namespace BondPerception {
+
+   // Indices of the two atoms of a bond
+   typedef std::pair<unsigned, unsigned> AtomPair;
+   typedef std::vector<AtomPair> AtomPairList;
+
+   /// Determines the connectivity from the atomic positions, which are
+   /// given as consecutive (x,y,z) triples.  This reproduces the results of
+   /// OBMol::ConnectTheDots, including the pruning of bonds on over-valent
+   /// atoms, but the candidate pairs are found on a uniform grid with cells
+   /// no smaller than the longest possible bond rather than by scanning a
+   /// list sorted by z.  The bonds are returned in the order Open Babel would
+   /// create them.
+   AtomPairList connect(std::vector<unsigned> const& atomicNumbers,
+      std::vector<double> const& coordinates);
+
+   /// Returns the pairs of hydrogen atoms closer than 0.76 Angstroms that
+   /// are not already bonded.  Open Babel leaves these unbonded.
+   AtomPairList hydrogenMolecules(std::vector<unsigned> const& atomicNumbers,
+      std::vector<double> const& coordinates, AtomPairList const& bonds);
+
+   /// Assigns the bond orders using OBMol::PerceiveBondOrders.  The orders
+   /// are returned in the same order as the bonds.
+   std::vector<int> bondOrders(std::vector<unsigned> const& atomicNumbers,
+      std::vector<double> const& coordinates, AtomPairList const& bonds,
+      int const charge = 0, unsigned const multiplicity = 1);
+
+} } // end namespace IQmol::BondPerception
@@ -25,11 +25,12 @@
 #include "PrimitiveLayer.h"
 
 
-class QFontMetrics;
-class QGLViewer;
 class QColor;
 
 namespace IQmol {
+
+class LabelRenderer;
+
 namespace Layer {
 
    /// Concrete Primitive class that represents a Charge.
@@ -38,6 +39,7 @@ namespace Layer {
       Q_OBJECT
 
       friend class Molecule;
+      friend class IQmol::LabelRenderer;
 
       public:
          Charge(double const charge, qglviewer::Vec const& position = 
@@ -47,7 +49,6 @@ namespace Layer {
          void draw();
          void drawFast() { }
          void drawSelected();
-         void drawLabel(QGLViewer& viewer, QFontMetrics& fontMetrics);
          void setCharge(double const charge);
 
          QString toString();
@@ -23,6 +23,7 @@
 
 #include "GLObjectLayer.h"
 #include "ContainerLayer.h"
+#include "LayerRegistry.h"
 #include "Viewer/Animator.h"
 #include "Grid/Property.h"
 #include "Process/JobInfo.h"
@@ -81,6 +82,14 @@ namespace IQmol {
 
             void setShaderKey(QString const& shaderKey) { m_shaderKey = shaderKey; }
 
+            /// Shadows Base::findLayers() with a version that caches the
+            /// results until the Layer tree changes.
+            template <class T>
+            QList<T*> findLayers(unsigned int flags = (Nested | Children))
+            {
+               return m_registry.findLayers<T>(flags);
+            }
+
             void updateVisibleObjectList()
             {
                m_visibleObjects = findLayers<Layer::GLObject>(Layer::Children | 
@@ -167,6 +176,7 @@ namespace IQmol {
             DrawStyle m_drawStyle;
             qglviewer::Frame m_frame;
             GLObjectList m_visibleObjects;
+            Registry m_registry;
       };
 
    }  // end namespace Layer
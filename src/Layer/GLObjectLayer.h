@@ -114,6 +114,7 @@ namespace Layer {
          qglviewer::Quaternion getRotation() { return m_frame.rotation(); }
 
          bool isTransparent() const { return 0.01 <= m_alpha && m_alpha < 0.99; }
+         bool isClipped() const { return m_clip; }
          //bool isTransparent() const { return m_alpha < 0.99; }
 
 		 /// Basic implmentation of an alpha sort so transparent objects can be
@@ -141,35 +142,50 @@ namespace Layer {
             s_cameraPivot = pivot; 
          }
 
+		 /// Incremented whenever an object is moved, resized or reshaped, so
+		 /// that bounds and pick buffers computed from the objects can be
+		 /// cached between frames (see LevelOfDetail and SelectionBuffer).
+		 /// Code that modifies m_frame directly, rather than through the
+		 /// functions below, must call geometryChanged() itself.
+         static unsigned geometryRevision() { return s_geometryRevision; }
+         static void geometryChanged() { ++s_geometryRevision; }
+
       public Q_SLOTS:
          virtual void setReferenceFrame(qglviewer::Frame* frame) { 
             m_frame.setReferenceFrame(frame); 
+            geometryChanged();
          }
 
          virtual void setFrame(qglviewer::Frame const& frame) {
             m_frame = frame;
+            geometryChanged();
          }
 
          virtual void setPosition(qglviewer::Vec const& position) {
             m_frame.setPosition(position); 
+            geometryChanged();
          }
 
          virtual void setOrientation(qglviewer::Quaternion const& orient) {
             m_frame.setOrientation(orient); 
+            geometryChanged();
          }
 
          virtual void setTranslation(qglviewer::Vec const& translation) {
             m_frame.setTranslation(translation); 
+            geometryChanged();
          }
 
          virtual void setRotation(qglviewer::Quaternion const& rotation) {
             m_frame.setRotation(rotation); 
+            geometryChanged();
          }
 
       protected:
          static qglviewer::Vec s_cameraPosition;
          static qglviewer::Vec s_cameraDirection;
          static qglviewer::Vec s_cameraPivot;
+         static unsigned s_geometryRevision;
          qglviewer::Frame m_frame;
          double m_alpha;   
          GLuint m_callList;
@@ -33,6 +33,7 @@ namespace Configurator {
 
    namespace Animator {
       class Base;
+      class BondTracker;
    }
    typedef QList<Animator::Base*> AnimatorList;
 
@@ -72,6 +73,8 @@ namespace Layer {
 
       private Q_SLOTS:
          void removeGeometry();
+         /// Called when a non-looping playback runs to the end.
+         void playbackFinished();
 
       private:
          void deleteAnimators();
@@ -80,6 +83,7 @@ namespace Layer {
          Configurator::GeometryList* m_configurator;
          Data::GeometryList& m_geometryList;
          AnimatorList m_animatorList;
+         Animator::BondTracker* m_bondTracker;
 
          unsigned m_defaultIndex;
          double m_speed;
@@ -79,8 +79,8 @@ namespace Layer {
          virtual ~Base();
 
 		 /// Allows custom property flags to be set for the Layer.
-         void setProperty(PropertyFlag const flag)   { m_propertyFlags |= flag; }
-         void unsetProperty(PropertyFlag const flag) { m_propertyFlags &= ~flag; }
+         void setProperty(PropertyFlag const flag)   { m_propertyFlags |= flag; treeChanged(); }
+         void unsetProperty(PropertyFlag const flag) { m_propertyFlags &= ~flag; treeChanged(); }
          bool hasProperty(PropertyFlag const flag) const { return m_propertyFlags & flag; }
 
 		 /// Appends a child Layer to the current Layer.  If the current Layer
@@ -100,6 +100,25 @@ namespace Layer {
 		 // QStandardItem to the Layer.
          virtual void setCheckStatus(Qt::CheckState const) { }
 
+		 /// Changes to the check state and item flags alter the results of
+		 /// findLayers(), so these are tracked via treeChanged().
+         virtual void setData(QVariant const& value, int role = Qt::UserRole + 1);
+
+		 /// The revision of a Layer, and those of its ancestors, is incremented
+		 /// whenever a Layer in its subtree is added, removed, deleted,
+		 /// (de)selected or has its check state changed.  Cached results of
+		 /// findLayers() are valid only while the revision of the Layer they
+		 /// were found from is unchanged (see Layer::Registry), so a change
+		 /// to one molecule leaves the caches of the others intact.
+		 /// treeRevision() counts the same changes over the whole scene.
+		 /// Code that manipulates rows directly with the QStandardItem
+		 /// functions, rather than through appendLayer() and removeLayer(),
+		 /// must call treeChanged() itself, on the Layer added or, before it
+		 /// is taken, on the Layer removed.
+         unsigned revision() const { return m_revision; }
+         void treeChanged();
+         static unsigned treeRevision() { return s_treeRevision; }
+
          template <class T>
          QList<T*> findLayers(unsigned int flags = (Nested | Children))
          {
@@ -246,11 +265,14 @@ namespace Layer {
             ptr->findParents<T>(parents, flags);
          }
 
+         static unsigned s_treeRevision;
+
          // Data members
          Configurator::Base* m_configurator;
          QList<QAction*> m_actions;
          Base* m_persistentParent;
          unsigned int m_propertyFlags;
+         unsigned m_revision;
    };
 
    typedef QList<Layer::Base*> List;
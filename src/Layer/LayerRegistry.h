@@ -0,0 +1,94 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Layer.h"
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <utility>
+
+
+namespace IQmol {
+namespace Layer {
+
+   /// Caches the results of Base::findLayers() for the subtree below a root
+   /// Layer.  A typed list is kept for each combination of Layer type and
+   /// FindFlags requested, so the visible and selected subsets are cached
+   /// alongside the full lists.  All the lists are discarded whenever the
+   /// revision of the root changes, which happens when a Layer below it is
+   /// added or removed and on changes to the selection or check state.
+   class Registry {
+
+      public:
+         explicit Registry(Base* root) : m_root(root), m_revision(0) { }
+
+         Registry(Registry const&) = delete;
+         Registry& operator=(Registry const&) = delete;
+
+         template <class T>
+         QList<T*> findLayers(unsigned int flags)
+         {
+            if (!s_enabled) return m_root->Base::findLayers<T>(flags);
+
+            if (m_revision != m_root->revision()) {
+               m_entries.clear();
+               m_revision = m_root->revision();
+            }
+
+            Key key(std::type_index(typeid(T)), flags);
+            auto iter(m_entries.find(key));
+            if (iter != m_entries.end()) {
+               return static_cast<TypedEntry<T>*>(iter->second.get())->layers;
+            }
+
+            TypedEntry<T>* entry(new TypedEntry<T>(m_root->Base::findLayers<T>(flags)));
+            m_entries[key].reset(entry);
+            return entry->layers;
+         }
+
+         void clear() { m_entries.clear(); }
+
+         /// Allows the cache to be bypassed, for benchmarking.
+         static void setEnabled(bool const enabled) { s_enabled = enabled; }
+         static bool isEnabled() { return s_enabled; }
+
+      private:
+         struct Entry {
+            virtual ~Entry() { }
+         };
+
+         template <class T>
+         struct TypedEntry : public Entry {
+            TypedEntry(QList<T*> const& list) : layers(list) { }
+            QList<T*> layers;
+         };
+
+         typedef std::pair<std::type_index, unsigned int> Key;
+
+         Base* m_root;
+         unsigned m_revision;
+         std::map<Key, std::unique_ptr<Entry>> m_entries;
+         static bool s_enabled;
+   };
+
+} } // end namespace IQmol::Layer
@@ -36,6 +36,7 @@
 #include "Math/Matrix.h"
 
 #include <QMap>
+#include <QHash>
 #include <QFileInfo>
 
 #include <functional>
@@ -137,8 +138,10 @@ bool save(bool prompt = false);
    
             /// Locates all atoms for which there exists a path to B without going through A.
             AtomList getContiguousFragment(Atom* A, Atom* B);
-            Bond* getBond(Atom*, Atom*);
-            BondList getBonds(Atom*);
+
+            /// These use the bond index maintained by reindexAtomsAndBonds()
+            Bond* getBond(Atom*, Atom*) const;
+            BondList getBonds(Atom*) const;
 
             bool isModified() const { return m_modified; }
    
@@ -174,6 +177,7 @@ bool save(bool prompt = false);
             QString coordinatesAsString(bool const selectedOnly = false);
             QString coordinatesAsStringFsm();
             QStringList coordinatesForCubeFile();
+            void saveToGeometry(Data::Geometry&);
 
             QString isotopesAsString();
    
@@ -204,6 +208,21 @@ bool save(bool prompt = false);
                  m_reperceiveBondsForAnimation = tf;
             }
 
+            /// Switches to a lightweight mode for playing back trajectories
+            /// and scans.  The atoms are indexed once here, after which
+            /// setGeometry() only updates the atomic positions and the bonds
+            /// are tracked incrementally using a neighbor grid.  The full
+            /// geometry update, including bond perception, is carried out by
+            /// endPlayback().
+            void beginPlayback();
+            void endPlayback();
+            bool inPlayback() const { return m_inPlayback; }
+
+            /// Adds and removes bonds based on the current atomic positions.
+            /// Only bonds that have changed since the last call are touched.
+            /// Does nothing unless in playback mode.
+            void updatePlaybackBonds();
+
 //            unsigned maxAtomicNumber() { return m_maxAtomicNumber; }
 
             void   setMullikenDecompositions(Matrix const& M);
@@ -325,11 +344,12 @@ bool save(bool prompt = false);
             void update(std::function<void(T&)>);
 
             void clearData();
+
+            void setPlaybackGeometry(Data::Geometry&);
+            void clearPlayback();
    
             void initProperties();
             void deleteProperties();
-
-            void saveToGeometry(Data::Geometry&);
    
             /// State variable that determines how the Primitives are drawn (e.g.
             /// CPK or wireframe)
@@ -375,6 +395,21 @@ bool save(bool prompt = false);
             QAction* m_addGeometryMenu;;
 
             Matrix m_mullikenDecompositions;
+
+            // Bond index, keyed on the atoms and on the (ordered) atom pairs
+            QHash<Atom*, BondList> m_atomBonds;
+            QHash<QPair<Atom*, Atom*>, Bond*> m_bondIndex;
+
+            // Playback state, see beginPlayback().  Bonds are keyed on the
+            // indices of their atoms in m_playbackAtoms.
+            bool m_inPlayback;
+            AtomList m_playbackAtoms;
+            QList<double> m_playbackRadii;
+            double m_playbackMaxRadius;
+            QHash<quint64, Bond*> m_playbackBonds;
+            QHash<quint64, Bond*> m_playbackRetiredBonds;
+            QList<Bond*> m_playbackCreatedBonds;
+            Data::Geometry* m_playbackGeometry;
       };
    
    } // end namespace Layer
@@ -116,6 +116,10 @@ namespace Layer {
          Data::GridData* findGrid(Data::SurfaceType const& type, 
             Data::GridSize const& size, Data::GridDataList const& gridList);
          Data::Surface* generateSurface(Data::SurfaceInfo const&);
+
+         /// Returns the GridCache key for the grid, or an empty string if
+         /// the grid is not cached.
+         QString cacheKey(Data::SurfaceType const&, Data::GridSize const&);
          void dumpGridInfo() const;
          void appendSurfaces(Data::SurfaceList&);
 
@@ -30,11 +30,10 @@
 #include <GL/glu.h>
 #endif
 
-class QGLViewer;
-class QFontMetrics;
-
 namespace IQmol {
 
+class LevelOfDetail;
+
 namespace Data {
    class Geometry;
 }
@@ -48,6 +47,8 @@ namespace Layer {
 
       Q_OBJECT
 
+      friend class IQmol::LevelOfDetail;
+
       public:
          enum DrawMode { BallsAndSticks, Tubes, SpaceFilling, WireFrame, Plastic };
 
@@ -56,11 +57,15 @@ namespace Layer {
            
          virtual ~Primitive() { }
 
-         virtual void drawLabel(QGLViewer&, QFontMetrics&) {  }
          virtual void setIndex(int const index) { m_index = index; }
          int  index() const { return m_index; }
-         void setScale(double const scale) { m_scale = scale; }
-         virtual void setDrawMode(DrawMode const drawMode) { m_drawMode = drawMode; }
+         void setScale(double const scale) { m_scale = scale; geometryChanged(); }
+         double scale() const { return m_scale; }
+         virtual void setDrawMode(DrawMode const drawMode) { 
+            m_drawMode = drawMode; 
+            geometryChanged(); 
+         }
+         DrawMode drawMode() const { return m_drawMode; }
          
          static double distance(Primitive* A, Primitive* B);
          static double angle(Primitive* A, Primitive* B, Primitive* C);
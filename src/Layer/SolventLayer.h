@@ -30,6 +30,8 @@ class QColor;
 
 namespace IQmol {
 
+class LevelOfDetail;
+
 namespace Layer {
 
    class Solvent : public GLObject {
@@ -41,6 +43,10 @@ namespace Layer {
 
          void draw();
          void drawFast() { draw(); }
+
+         /// Draws only the spheres in view, with the tessellation set by
+         /// their projected size.  Distant spheres are drawn as points.
+         void draw(LevelOfDetail const&);
          void drawSelected() { draw(); }
 
          QColor color() const { 
@@ -25,6 +25,8 @@
 #include "Configurator/SurfaceConfigurator.h"
 #include "Data/Surface.h"
 #include <QColor>
+#include <QPointer>
+#include <QOpenGLContext>
 
 
 namespace IQmol {
@@ -59,6 +61,7 @@ namespace IQmol {
    
             void draw();
             void drawFast();
+            void drawFlat();
             void drawSelected();
             void setAlpha(double const alpha);
             void setDrawMode(GLObject::DrawMode const mode) { m_drawMode = mode; }
@@ -99,8 +102,32 @@ namespace IQmol {
             void dumpMeshInfo() const;
    
          private:
+            // Mesh data held in buffer objects.  The vertex buffer holds the
+            // positions, followed by the normals and, for surfaces colored by
+            // a property, the scalar field value at each vertex.
+            struct Buffers {
+               Buffers() : vertexBuffer(0), indexBuffer(0), colorBuffer(0),
+                  nVertices(0), nIndices(0), hasScalar(false) { }
+               GLuint  vertexBuffer;
+               GLuint  indexBuffer;
+               GLuint  colorBuffer;  // Only used if the gradient shader is unavailable
+               GLsizei nVertices;
+               GLsizei nIndices;
+               bool    hasScalar;
+            };
+
+            // Flags the buffers for upload on the next draw.  Only needed when
+            // the geometry or property data change; colors, alpha and the
+            // property range are passed to the GPU as uniforms.
             void recompile();
-            GLuint compile(Data::Mesh const&);
+            void upload(Data::Mesh const&, Buffers&);
+            void uploadColors(Data::Mesh const&, Buffers&);
+            void uploadGradient();
+            void release(Buffers&);
+            // A null color draws the geometry only, leaving the color and
+            // program to the caller (see drawFlat).
+            void drawBuffers(Buffers const&, GLfloat const* color);
+            static GLuint gradientProgram(QOpenGLContext*);
 
             // hack for ordering the surfaces
             // bool isTransparent() const { return 0.01 <= m_alpha && m_alpha < 0.99; }
@@ -115,8 +142,14 @@ namespace IQmol {
             Configurator::Surface m_configurator;
             GLObject::DrawMode m_drawMode;
    
-            GLuint  m_callListPositive; 
-            GLuint  m_callListNegative; 
+            // The context the buffers and gradient texture were created in
+            QPointer<QOpenGLContext> m_context;
+            Buffers m_buffersPositive;
+            Buffers m_buffersNegative;
+            GLuint  m_gradientTexture;
+            bool    m_buffersStale;
+            bool    m_gradientStale;
+            bool    m_colorsStale;
             GLfloat m_colorPositive[4];
             GLfloat m_colorNegative[4];
 
@@ -0,0 +1,156 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Data/Bank.h"
+#include "Viewer/Viewer.h"
+#include "Viewer/ViewerModel.h"
+#include <QColor>
+#include <QElapsedTimer>
+#include <QList>
+#include <QPair>
+#include <QStringList>
+#include <QThreadPool>
+
+
+class QJsonObject;
+
+namespace IQmol {
+
+   namespace Data {
+      class Surface;
+   }
+
+   /// Runs IQmol without the MainWindow, generating surfaces, images and
+   /// POV-Ray files for a list of files given in a JSON job specification:
+   ///
+   ///   {
+   ///      "files":    [ "water.fchk", "benzene.fchk" ],
+   ///      "output":   "images",          // directory, default is the spec's
+   ///      "threads":  4,                 // files processed concurrently
+   ///      "surfaces": [
+   ///         { "orbital": "homo",   "spin": "alpha", "isovalue": 0.02, "quality": 3 },
+   ///         { "orbital": "lumo+1" },
+   ///         { "orbital": 12 },        // counting from 1, as in the GUI
+   ///         { "density": "total", "isovalue": 0.001 },
+   ///         { "cube": true, "isovalue": 0.05 }
+   ///      ],
+   ///      "image":  { "width": 1024, "height": 768, "antialias": 4, "dpi": 300 },
+   ///      "povray": true,
+   ///      "camera": { "position": [0, 0, 20], "lookAt": [0, 0, 0], 
+   ///                  "up": [0, 1, 0], "fieldOfView": 45 }
+   ///   }
+   ///
+   /// Paths are relative to the specification file and the isovalues are in
+   /// the same units as the surface dialog without atomic units.  Parsing,
+   /// grid evaluation and the marching cubes run on a thread pool; the
+   /// resulting Molecules are then rendered one at a time on the GUI thread,
+   /// which owns the GL context.  The Viewer is never shown on screen.  By
+   /// default the offscreen platform plugin is used if an X display is
+   /// available, as Qt's offscreen plugin only provides OpenGL through GLX,
+   /// and minimalegl otherwise, which needs EGL but no display.  Other 
+   /// platforms can be chosen with QT_QPA_PLATFORM.  If no GL context can be
+   /// created the surfaces are still computed but every file is reported as
+   /// failed.  Each file's OpenMP regions use an equal share of the cores.
+   /// Cube files with grids too large to load are streamed through
+   /// SlabMarchingCubes, so only the cube surfaces are available for these.
+   class BatchRunner : public QObject {
+
+      Q_OBJECT
+
+      public:
+         BatchRunner(QObject* parent = 0);
+         ~BatchRunner();
+
+         /// Reads the specification and queues the files.  Returns false,
+         /// after printing the reason, if the specification is invalid.
+         bool start(QString const& specFile);
+
+      Q_SIGNALS:
+         /// Emitted once every file has been processed.
+         void finished(int failures);
+
+      private:
+         struct SurfaceRequest {
+            enum Source { Orbital, Density, Cube };
+            Source  source;
+            QString orbital;   // homo, lumo or a number, with an optional offset
+            QString density;   // alpha, beta, total, spin or a density label
+            bool    beta;
+            bool    isSigned;
+            bool    simplify;
+            double  isovalue;
+            unsigned quality;
+         };
+
+         struct Job {
+            QString filePath;
+            Data::Bank bank;
+            QStringList errors;
+            QList<QPair<QString, double> > timings;  // seconds
+         };
+
+         bool parseSurfaces(QJsonObject const&);
+         bool parseCamera(QJsonObject const&);
+
+         // Run on the thread pool
+         void process(Job*);
+         void computeOrbitalSurfaces(Job*, Data::Bank&);
+         void computeCubeSurfaces(Job*, Data::Bank&);
+         bool streamCubeSurfaces(Job*);
+
+         // Run on the GUI thread
+         void render(Job*);
+         void report();
+
+         QString m_outputDirectory;
+         QList<SurfaceRequest> m_surfaces;
+         QColor m_positiveColor;
+         QColor m_negativeColor;
+         double m_errorBound;
+
+         QSize m_imageSize;
+         int   m_antialias;
+         int   m_dpi;
+         bool  m_image;
+         bool  m_povray;
+
+         bool  m_camera;
+         qglviewer::Vec m_cameraPosition;
+         qglviewer::Vec m_cameraLookAt;
+         qglviewer::Vec m_cameraUp;
+         double m_fieldOfView;
+
+         ViewerModel m_viewerModel;
+         Viewer*     m_viewer;
+         QString     m_renderError;
+
+         QThreadPool m_pool;
+         int m_ompThreads;   // per file
+         QList<Job*> m_jobs;
+         int m_pending;
+         QElapsedTimer m_time;
+
+         friend class BatchWorker;
+   };
+
+} // end namespace IQmol
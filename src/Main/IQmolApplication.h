@@ -47,6 +47,10 @@ namespace IQmol {
 
          void exception();
 
+         /// Processes the files in the JSON job specification without
+         /// opening a MainWindow and returns the exit code.
+         int runBatch(QString const& specFile);
+
       protected:
          bool event(QEvent*);
 
@@ -0,0 +1,61 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2023 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <complex>
+#include <vector>
+
+
+namespace IQmol {
+namespace Math {
+
+   using Complex = std::complex<double>;
+
+   /// Returns the smallest power of two that is >= n
+   unsigned nextPowerOfTwo(unsigned const n);
+
+   /// Radix-2 fast Fourier transform of a fixed length, which must be a power
+   /// of two.  The twiddle factors and bit-reversal permutation are computed
+   /// once in the ctor so the object can be reused for many transforms.  The
+   /// inverse transform includes the 1/n normalization.
+   class FFT {
+
+      public:
+         explicit FFT(unsigned const n);
+
+         unsigned size() const { return m_n; }
+
+         // In-place transform of n contiguous values
+         void transform(Complex* data, bool const inverse = false) const;
+
+      private:
+         unsigned m_n;
+         std::vector<Complex> m_twiddles;
+         std::vector<unsigned> m_bitReverse;
+   };
+
+   /// In-place 3D transform of a row-major n0 x n1 x n2 array.  Each
+   /// dimension must be a power of two.
+   void fft3d(std::vector<Complex>& data, unsigned const n0, unsigned const n1, 
+      unsigned const n2, bool const inverse = false);
+
+} } // end namespace IQmol::Math
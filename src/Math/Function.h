@@ -22,6 +22,7 @@
 ********************************************************************************/
 
 #include "Vector.h"
+#include "Matrix.h"
 #include <functional>
 
 
@@ -31,6 +32,11 @@ using Function3D = std::function<double (double const, double const, double cons
 using MultiFunction3D = std::function<void (double const, double const, double const, Vector&)>;
 using IndexMap = std::function<int (int const)>;
 
+// Block form of a MultiFunction3D which evaluates n points given in
+// structure-of-arrays form, filling values(f,p) for function f at point p.
+using BlockFunction3D = std::function<void (unsigned const n, double const* x,
+   double const* y, double const* z, Matrix& values)>;
+
 static Function3D NullFunction3D;
 
 
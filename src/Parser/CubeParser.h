@@ -22,7 +22,9 @@
 ********************************************************************************/
 
 #include "Parser.h"
+#include "Data/GridSize.h"
 #include "QGLViewer/vec.h"
+#include <QFile>
 
 
 namespace IQmol {
@@ -51,19 +53,58 @@ namespace Parser {
    class Cube : public Base {
 
       public:
+         /// Memory-maps the file, falling back to Base::parseFile if that
+         /// is not possible.
+         bool parseFile(QString const& filePath);
          bool parse(TextStream&);
          bool save(QString const& filePath, Data::Bank&);
 
-      private:
-         int parseGridAxes(TextStream& textStream);
-		 bool parseCoordinates(TextStream& textStream, unsigned nAtoms);
-         void parseGridData(TextStream& textStream);
-         QStringList formatCoordinates(Data::Geometry const&);
+      protected:
+         /// Parses the header and coordinates, returning the start of the
+         /// grid data, or 0 on error.
+         char const* parseHeader(char const* begin, char const* end);
 
          int m_nx, m_ny, m_nz;
          double m_scale;
          qglviewer::Vec m_origin;
          qglviewer::Vec m_delta;
+
+      private:
+         int parseGridAxes(TextStream& textStream);
+		 bool parseCoordinates(TextStream& textStream, unsigned nAtoms);
+         bool parse(char const* begin, char const* end);
+         void parseGridData(char const* begin, char const* end);
+         QStringList formatCoordinates(Data::Geometry const&);
+   };
+
+
+   /// Reads the grid of a cube file one x-plane at a time, for grids that
+   /// are too large to hold in memory.  The file stays mapped, so only the
+   /// plane being converted need be resident, and the geometry is available
+   /// in data() once the file has been opened.
+   class CubeSlabReader : public Cube {
+
+      public:
+         CubeSlabReader() : m_map(0), m_position(0), m_end(0), m_plane(0), 
+            m_bytesPerValue(16.0) { }
+         ~CubeSlabReader();
+
+         /// Parses the header and coordinates, returns false on error.
+         bool open(QString const& filePath);
+
+         Data::GridSize gridSize() const;
+
+		 /// Reads the next plane of ny*nz values, with z varying fastest.
+		 /// Returns false after the last plane or on error.
+         bool readPlane(double* values);
+
+      private:
+         QFile m_file;
+         uchar* m_map;
+         char const* m_position;
+         char const* m_end;
+         unsigned m_plane;
+         double m_bytesPerValue;  // of the previous plane, to size the window
    };
 
 } } // end namespace IQmol::Parser
@@ -29,6 +29,8 @@
 #include "Data/Orbitals.h"
 #include "Data/ExcitedStates.h"
 
+#include <vector>
+
 
 namespace IQmol {
 
@@ -41,12 +43,30 @@ namespace Parser {
    class FormattedCheckpoint : public Base {
 
       public:
+         /// Memory-maps the file, falling back to Base::parseFile if that
+         /// is not possible.
+         bool parseFile(QString const& filePath);
          bool parse(TextStream&);
 
       private:
-         QList<int> readIntegerArray(TextStream&, unsigned nTokens);
-         QList<double> readDoubleArray(TextStream&, unsigned nTokens);
-         QList<unsigned> readUnsignedArray(TextStream&, unsigned nTokens);
+         /// A header line and the data lines that follow it.
+         struct Section {
+            QString key;
+            QStringList tokens;   // The type and size columns
+            char const* begin;
+            char const* end;
+            unsigned lineNumber;
+         };
+
+         /// Finds all the sections in a single pass, header lines are 
+         /// those that start with a letter.
+         QList<Section> indexSections(char const* begin, char const* end);
+         bool parse(char const* begin, char const* end);
+
+         QList<int> readIntegerArray(Section const&, unsigned nTokens);
+         QList<double> readDoubleArray(Section const&, unsigned nTokens);
+         std::vector<double> readDoubleVector(Section const&, unsigned nTokens);
+         QList<unsigned> readUnsignedArray(Section const&, unsigned nTokens);
          bool toInt(unsigned& n, QStringList const&, unsigned const index);
          bool toDouble(double& x, QStringList const&, unsigned const index);
 
@@ -67,8 +87,10 @@ namespace Parser {
             QString label;
 
             QStringList   labels;
-            QList<double> alphaCoefficients;
-            QList<double> betaCoefficients;
+            // The coefficients are the largest arrays in the file, so these
+            // are kept in the form they are read in.
+            std::vector<double> alphaCoefficients;
+            std::vector<double> betaCoefficients;
             QList<double> alphaEnergies;
             QList<double> betaEnergies;
          };
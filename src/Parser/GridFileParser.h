@@ -0,0 +1,87 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Parser.h"
+
+class QFileDevice;
+
+
+namespace IQmol {
+
+namespace Data {
+   class Geometry;
+   class GridData;
+}
+
+namespace Parser {
+
+   /// Reads and writes the binary grid format (.iqgrid), which holds the
+   /// geometry and one or more grids in a form that can be read back without
+   /// any text conversion.  All quantities are little-endian:
+   ///
+   ///   char[8]    magic "IQGRID" padded with zeros
+   ///   uint32     version, number of atoms, number of grids, reserved
+   ///   atoms      uint32 Z; float64 x, y, z in angstroms
+   ///   grids      each starting on an 8-byte boundary:
+   ///      int32   SurfaceType kind
+   ///      uint32  SurfaceType index, nx, ny, nz
+   ///      uint32  bytes per value, 4 or 8
+   ///      uint32  codec, see below
+   ///      uint32  values per chunk
+   ///      uint32  label length, followed by the UTF-8 label
+   ///      float64 origin and delta, in angstroms, on an 8-byte boundary
+   ///      uint64  size of each stored chunk (compressed grids only)
+   ///      payload, values with z varying fastest
+   ///
+   /// With the Shuffle codec each chunk has the bytes of its values grouped
+   /// by significance, as in blosc, before zlib compression.  The chunks are
+   /// compressed and expanded in parallel.
+   class GridFile : public Base {
+
+      public:
+         enum Precision { Single = 4, Double = 8 };
+         enum Codec { None = 0, Shuffle = 1 };
+
+         /// Memory-maps the file and appends the Geometry and a CubeData
+         /// for each grid.
+         bool parseFile(QString const& filePath);
+
+         /// Writes the grids, which are assumed to belong to the geometry.
+         /// Single precision halves the size, at the cost of accuracy.
+         bool save(QString const& filePath, Data::Geometry const&, 
+            QList<Data::GridData*> const&, Precision const = Double, 
+            bool const compress = true);
+
+         /// As above, but writes to a file that is already open, such as a
+         /// QTemporaryFile.
+         bool save(QFileDevice&, Data::Geometry const&, 
+            QList<Data::GridData*> const&, Precision const = Double, 
+            bool const compress = true);
+
+         static const char* Extension;
+
+      private:
+         bool parse(char const* begin, char const* end);
+   };
+
+} } // end namespace IQmol::Parser
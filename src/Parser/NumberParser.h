@@ -0,0 +1,58 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <cstddef>
+
+
+namespace IQmol {
+namespace Parser {
+
+   /// Reads the first n whitespace-separated numbers in [begin, end) into
+   /// values, which must have room for n doubles.  The range is split at
+   /// whitespace into chunks that are converted in parallel with 
+   /// std::from_chars, so no intermediate strings or lists are created and
+   /// the range can be a memory-mapped file.  Returns the number of values
+   /// read, which is less than n if the range runs out, or -1 if a token is
+   /// not a valid number.  If next is given it is set to the position
+   /// following the last value read.
+   long ParseDoubles(char const* begin, char const* end, double* values, size_t const n,
+      char const** next = 0);
+
+   /// Reads the first n values written in fixed-width fields, as with the
+   /// Fortran formats used for arrays in formatted checkpoint files (5E16.8
+   /// and 6I12).  Fields are taken by position rather than by splitting on
+   /// whitespace, so values that fill their field are still read correctly.
+   /// The lines are indexed in a single pass and then converted in parallel
+   /// directly into values, which must have room for n numbers.  The return
+   /// value and next are as for ParseDoubles.
+   long ParseFixedWidth(char const* begin, char const* end, unsigned const width,
+      double* values, size_t const n, char const** next = 0);
+   long ParseFixedWidth(char const* begin, char const* end, unsigned const width,
+      int* values, size_t const n, char const** next = 0);
+   long ParseFixedWidth(char const* begin, char const* end, unsigned const width,
+      unsigned* values, size_t const n, char const** next = 0);
+
+   /// Returns the position following the next n newlines, or end.
+   char const* SkipLines(char const* begin, char const* end, unsigned const n);
+
+} } // end namespace IQmol::Parser
@@ -0,0 +1,59 @@
+#ifndef IQMOL_UTIL_GLCONTEXTGUARD_H
+#define IQMOL_UTIL_GLCONTEXTGUARD_H
+#define IQMOL_UTIL_OPENGL_H
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+
+class QOpenGLContext;
+class QOffscreenSurface;
+class QSurface;
+
+namespace IQmol {
+
+/// Makes the given context current for the lifetime of the guard so that GL
+/// objects belonging to it can be released outside of paintGL, for example
+/// from a destructor.  If the context is not already current it is made
+/// current on a temporary offscreen surface, and the previously current
+/// context is restored when the guard goes out of scope.  The guard is
+/// invalid if the context is null or cannot be made current, in which case
+/// the GL objects have either gone with the context or cannot be reached.
+class GLContextGuard {
+
+   public:
+      explicit GLContextGuard(QOpenGLContext*);
+      ~GLContextGuard();
+
+      bool isValid() const { return m_valid; }
+
+   private:
+      GLContextGuard(GLContextGuard const&);
+      GLContextGuard& operator=(GLContextGuard const&);
+
+      QOpenGLContext* m_context;
+      QOpenGLContext* m_previous;
+      QSurface* m_previousSurface;
+      QOffscreenSurface* m_surface;
+      bool m_valid;
+};
+
+} // end namespace IQmol
+
+#endif
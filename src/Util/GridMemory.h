@@ -0,0 +1,40 @@
+#ifndef IQMOL_UTIL_GRIDMEMORY_H
+#define IQMOL_UTIL_GRIDMEMORY_H
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <cstddef>
+
+namespace IQmol {
+namespace Util {
+
+/// Returns the size of the physical memory in bytes, or 0 if unknown
+size_t PhysicalMemory();
+
+/// Returns the largest number of doubles a grid may hold in memory.  This is
+/// set by the MaxGridMemory preference, or is half the physical memory if 
+/// that is not set.  Grids larger than this are not loaded.
+size_t MaxGridPoints();
+
+} }  // end namespace IQmol::Util
+
+#endif
@@ -111,6 +111,25 @@ namespace Preferences {
 
    double  SymmetryTolerance();
    void    SymmetryTolerance(double const);
+
+   // Error bound for the adaptive grid refinement, a value <= 0 disables it
+   double  AdaptiveGridErrorBound();
+   void    AdaptiveGridErrorBound(double const);
+
+   // Whether Open Babel is used to assign bond orders when the bonds are
+   // determined automatically, otherwise all bonds are single
+   bool    PerceiveBondOrders();
+   void    PerceiveBondOrders(bool const);
+
+   // Memory, in MB, allowed for a single grid read from a file, a value
+   // <= 0 means half the physical memory
+   int     MaxGridMemory();
+   void    MaxGridMemory(int const);
+
+   // Size limit, in MB, of the on-disk cache of computed grids, a value <= 0
+   // disables the cache
+   int     GridCacheSize();
+   void    GridCacheSize(int const);
    
    QColor PositiveSurfaceColor();
    void   PositiveSurfaceColor(QColor const&);
@@ -76,9 +76,10 @@ namespace IQmol {
 
 
       public Q_SLOTS:
-         virtual void start() {
-            m_thread->start();
-         }
+		 /// Runs the task on its thread.  With OpenMP, parallel regions in
+		 /// the task use no more threads than they would on the thread
+		 /// calling start(), so a cap set there (see BatchRunner) applies.
+         virtual void start();
 
 		 /// This simply sets the m_terminate flag and does not actually kill
 		 /// the thread.  It is up to the dervived clasess to check the value
@@ -111,6 +112,7 @@ namespace IQmol {
          bool     m_deleteThread;
          double   m_time;
          int      m_timeout;  // in msec
+         int      m_maxThreads;
 
          // No copying allowed
          Task(Task const&);
@@ -167,6 +167,25 @@ namespace Animator {
 
 
 
+   /// Keeps the bonds of a molecule in playback mode up to date while its
+   /// atoms are being moved by other animators.  It should be pushed after
+   /// those animators and runs until it is popped.
+   class BondTracker : public Base {
+
+      Q_OBJECT
+
+      public:
+         BondTracker(Layer::Molecule* molecule) : Base(-1.0, 1.0, Ramp), 
+            m_molecule(molecule) { }
+
+         void update(double const time, double const amplitude);
+
+      private:
+         Layer::Molecule* m_molecule;
+   };
+
+
+
    // This works a little differently from the other animators.  We must first
    // generate a list of surfaces and this class is repsonsible for determining
    // which one needs to be visible at a given time.
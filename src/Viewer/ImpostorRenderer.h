@@ -0,0 +1,95 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Layer/GLObjectLayer.h"
+#include <vector>
+
+
+namespace IQmol {
+
+   namespace Layer {
+      class Atom;
+      class Bond;
+   }
+
+   /// Draws the atoms and bonds of large systems as ray-cast sphere and
+   /// cylinder impostors.  Each frame the eligible primitives are gathered
+   /// into a vertex buffer holding one screen-aligned quad per primitive, and
+   /// all the spheres and all the cylinders are then drawn with one call each.
+   /// Primitives that are selected, transparent or drawn in the WireFrame or
+   /// Plastic modes are left to their own draw() functions, as are all the
+   /// primitives of small systems, where the tessellated geometry is cheap and
+   /// picks up the user-selected shader.
+   class ImpostorRenderer {
+
+      public:
+         ImpostorRenderer();
+         ~ImpostorRenderer();
+
+         /// Draws the objects that can be represented by impostors and
+         /// returns the remainder, which should be drawn as usual.  Requires
+         /// a current GL context.
+         GLObjectList draw(GLObjectList const& objects);
+
+         /// Impostors are only used when at least this many primitives
+         /// can be batched.
+         static constexpr int MinimumPrimitives = 1000;
+
+      private:
+         // A quad corner.  For spheres "other" is unused; for cylinders
+         // corner.x selects the end and corner.y the side.  corner.z holds
+         // the radius.
+         struct Vertex {
+            GLfloat position[3];
+            GLfloat other[3];
+            GLfloat corner[3];
+            GLfloat color[4];
+         };
+
+         struct Batch {
+            Batch() : buffer(0), count(0) { }
+            std::vector<Vertex> vertices;
+            std::vector<Vertex> uploaded;
+            GLuint  buffer;
+            GLsizei count;
+         };
+
+         bool addAtom(Layer::Atom*);
+         bool addBond(Layer::Bond*);
+         void addSphere(qglviewer::Vec const& center, GLfloat radius, GLfloat const* color);
+         void addCylinder(qglviewer::Vec const& a, qglviewer::Vec const& b, GLfloat radius,
+            GLfloat const* color);
+
+         void drawBatch(Batch&, GLuint program);
+         bool initPrograms();
+
+         Batch m_spheres;
+         Batch m_cylinders;
+         // Batched atoms whose displacement vectors are to be drawn
+         std::vector<Layer::Atom*> m_displaced;
+         GLuint m_sphereProgram;
+         GLuint m_cylinderProgram;
+         bool m_initialized;
+   };
+
+} // end namespace IQmol
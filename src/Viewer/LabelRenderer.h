@@ -0,0 +1,145 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Layer/AtomLayer.h"
+#include <QColor>
+#include <QFont>
+#include <QHash>
+#include <QMap>
+#include <QOpenGLContext>
+#include <QPointer>
+#include <QRectF>
+#include <vector>
+
+
+namespace IQmol {
+
+   /// Glyphs of a single font rasterized into one alpha texture.  Glyphs
+   /// are added on demand and packed into rows; the texture is uploaded the
+   /// next time it is bound.  If the atlas fills up its height is doubled,
+   /// which changes the texture coordinates of every glyph, so users of the
+   /// atlas should compare generation() with the value they last built with.
+   class GlyphAtlas {
+
+      public:
+         struct Glyph {
+            QRectF texture;   // Normalized texture coordinates, y down
+            QRectF quad;      // Pixels relative to the pen on the baseline, y up,
+                              // so top() is the lower edge
+            double advance;
+         };
+
+         GlyphAtlas(QFont const& font);
+         ~GlyphAtlas();
+
+         Glyph const& glyph(QChar const);
+         double width(QString const&);
+         double height() const { return m_height; }
+         unsigned generation() const { return m_generation; }
+
+         /// Uploads any new glyphs and binds the texture to the active unit.
+         void bind();
+
+      private:
+         void rasterize(QChar const, Glyph&);
+         void grow();
+
+         QFont m_font;
+         double m_height;
+         unsigned m_generation;
+
+         QHash<QChar, Glyph> m_glyphs;
+         std::vector<GLubyte> m_pixels;
+         int m_width;
+         int m_rows;
+
+         // Shelf packing state
+         int m_x, m_y, m_shelfHeight;
+
+         QPointer<QOpenGLContext> m_context;
+         GLuint m_texture;
+         bool m_dirty;
+   };
+
+
+   /// Draws the atom labels as textured quads.  The quads of all the labels
+   /// of one type are held in a single vertex buffer, which is only rebuilt
+   /// when the labels or the positions of the atoms change; the camera only
+   /// enters through the vertex shader, which places each label just in
+   /// front of its atom and sizes the quads in screen pixels.  The labels
+   /// are depth tested against the scene, as with the text they replace.
+   class LabelRenderer {
+
+      public:
+         LabelRenderer();
+         ~LabelRenderer();
+
+         /// Marks all the label buffers as out of date, for changes that
+         /// cannot be detected from the Layer tree, such as atoms moving.
+         void invalidate() { ++m_revision; }
+
+         /// Draws the labels of the given type for the atoms in the list,
+         /// and also for any Charges if the type is Layer::Atom::Charge.
+         /// The font size should be in device pixels.  Requires a current
+         /// GL context with the modelview and projection matrices loaded.
+         void draw(GLObjectList const& objects, Layer::Atom::LabelType const, 
+            QFont const& font, QColor const& color);
+
+      private:
+         struct Vertex {
+            GLfloat anchor[4];   // Position and radius of the atom
+            GLfloat offset[2];   // Pixels from the anchor
+            GLfloat texCoord[2];
+         };
+
+         struct Batch {
+            Batch() : buffer(0), count(0), revision(0), treeRevision(0), 
+               generation(0), atlas(0) { }
+            GLuint   buffer;
+            GLsizei  count;
+            unsigned revision;
+            unsigned treeRevision;
+            unsigned generation;
+            GlyphAtlas* atlas;
+            GLObjectList objects;
+         };
+
+         bool initProgram();
+         GlyphAtlas* atlas(QFont const&);
+         void build(Batch&, GLObjectList const&, Layer::Atom::LabelType const);
+         void addLabel(std::vector<Vertex>&, qglviewer::Vec const& position, 
+            double const radius, QString const& label, GlyphAtlas&);
+
+         QMap<int, Batch> m_batches;
+         QHash<QString, GlyphAtlas*> m_atlases;
+         unsigned m_revision;
+
+         QPointer<QOpenGLContext> m_context;
+         GLuint m_program;
+         GLint  m_viewportLocation;
+         GLint  m_colorLocation;
+         GLint  m_atlasLocation;
+         bool   m_initialized;
+   };
+
+} // end namespace IQmol
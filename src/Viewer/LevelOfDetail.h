@@ -0,0 +1,112 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Layer/GLObjectLayer.h"
+#include <QHash>
+#include <vector>
+
+
+namespace qglviewer {
+   class Camera;
+}
+
+namespace IQmol {
+
+   namespace Layer {
+      class Atom;
+      class Bond;
+      class Molecule;
+      class Solvent;
+   }
+
+   typedef QList<Layer::Molecule*> MoleculeList;
+
+   /// Culling and level-of-detail stage for the Viewer.  Each frame the
+   /// bounding spheres of the atoms of each molecule, and then of the 
+   /// individual atoms and bonds, are tested against the view frustum.  Atoms that survive
+   /// are given a tessellation based on their projected radius, and those
+   /// smaller than PointRadius pixels are collected and drawn as points,
+   /// unless they are selected.  The bounding spheres of the molecules are
+   /// cached until the Layer tree below them or the geometry changes.
+   /// Objects of large systems that are left in the list are picked up by
+   /// the ImpostorRenderer, whose quality does not depend on tessellation.
+   class LevelOfDetail {
+
+      public:
+         /// Primitives with a projected radius below this, in pixels, are
+         /// drawn as points.
+         static constexpr double PointRadius = 1.5;
+
+         LevelOfDetail();
+
+         /// Sets up the frustum for the current frame and clears the
+         /// results from the previous one.
+         void setCamera(qglviewer::Camera const&);
+
+         /// Returns the objects that need drawing.  Atoms that are drawn as
+         /// points and Solvent layers are removed from the list; these are
+         /// drawn with drawPoints() and drawSolvent().
+         GLObjectList cull(GLObjectList const& objects, MoleculeList const& molecules);
+
+         /// Draws the objects, setting the tessellation for the atoms and
+         /// bonds from the resolution determined in cull().
+         void drawObjects(GLObjectList const& objects);
+
+         void drawPoints();
+         void drawSolvent();
+
+         bool isVisible(qglviewer::Vec const& center, double const radius) const;
+         double pixelRadius(qglviewer::Vec const& center, double const radius) const;
+
+         /// Tessellation for a sphere with the given projected radius,
+         /// capped at the user resolution.
+         int resolution(double const pixelRadius) const;
+
+      private:
+         bool cullAtom(Layer::Atom*);
+         bool cullBond(Layer::Bond*);
+         bool isVisible(Layer::Molecule*);
+
+         struct Bounds {
+            qglviewer::Vec center;
+            double radius;
+            unsigned treeRevision;
+            unsigned geometryRevision;
+         };
+
+         Bounds const& bounds(Layer::Molecule*);
+
+         qglviewer::Camera const* m_camera;
+         QHash<Layer::Molecule*, Bounds> m_bounds;
+         GLdouble m_planes[6][4];
+
+         QHash<Layer::GLObject*, int> m_resolutions;
+         QList<Layer::Solvent*> m_solvents;
+
+         // Point vertices and colors, binned by diameter in pixels
+         static const int PointBins = 3;
+         std::vector<GLfloat> m_pointVertices[PointBins];
+         std::vector<GLfloat> m_pointColors[PointBins];
+   };
+
+} // end namespace IQmol
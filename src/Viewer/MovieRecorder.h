@@ -0,0 +1,128 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QSemaphore>
+#include <QByteArray>
+#include <QOpenGLBuffer>
+#include <QSize>
+#include <QStringList>
+#include <QThread>
+
+
+class QOpenGLFramebufferObject;
+class QProcess;
+
+namespace IQmol {
+
+   class Viewer;
+
+   /// Lives on the MovieRecorder's worker thread and feeds the raw frames to
+   /// ffmpeg through its standard input.  The blocking writes happen here so
+   /// a slow encoder only ever holds up this thread.
+   class MovieEncoder : public QObject {
+
+      Q_OBJECT
+
+      public:
+         MovieEncoder(QSemaphore& slots) : m_process(0), m_slots(slots) { }
+
+      Q_SIGNALS:
+         void finished(bool ok, QString const& errors);
+
+      public Q_SLOTS:
+         void start(QString const& program, QStringList const& args);
+         void encode(QByteArray const& frame);
+         void finish();
+
+      private:
+         QProcess* m_process;
+         QSemaphore& m_slots;
+   };
+
+
+   /// Records movie frames without touching the disk or blocking the render
+   /// loop.  Each frame is drawn into an offscreen framebuffer and read back
+   /// into one of a ring of pixel buffer objects; the frame is only mapped
+   /// PixelBuffers-1 captures later, by which time the transfer has
+   /// completed.  The mapped pixels are handed to a MovieEncoder on a worker
+   /// thread.  At most MaxQueuedFrames can be waiting for the encoder, any
+   /// further frames are dropped and counted rather than stalling the Viewer.
+   class MovieRecorder : public QObject {
+
+      Q_OBJECT
+
+      public:
+         static const int PixelBuffers    = 3;
+         static const int MaxQueuedFrames = 16;
+
+         /// The quality is the x264 constant rate factor, lower is better.
+         MovieRecorder(Viewer* viewer, QSize const& size, double const framerate, 
+            int const antialias, int const quality, QObject* parent = 0);
+         ~MovieRecorder();
+
+         /// Launches ffmpeg writing to the given file.
+         void start(QString const& ffmpeg, QString const& fileName);
+
+         /// The number of frames requested, and of those the number that
+         /// were dropped because the encoder had fallen behind.
+         unsigned captured() const { return m_captured; }
+         unsigned dropped() const { return m_dropped; }
+
+      Q_SIGNALS:
+         void finished(bool ok, QString const& errors);
+
+         // Internal, queued to the encoder
+         void startEncoder(QString const& program, QStringList const& args);
+         void encode(QByteArray const& frame);
+         void finishEncoder();
+
+      public Q_SLOTS:
+         void capture();
+         /// Flushes the frames still in the pixel buffers and closes the
+         /// stream.  finished() is emitted once ffmpeg has exited.
+         void finish();
+
+      private:
+         void collect(int const index);
+
+         Viewer* m_viewer;
+         QSize   m_size;
+         double  m_framerate;
+         int     m_antialias;
+         int     m_quality;
+
+         QOpenGLFramebufferObject* m_renderBuffer;
+         QOpenGLFramebufferObject* m_resolveBuffer;
+         QOpenGLBuffer m_pixelBuffers[PixelBuffers];
+         bool m_pending[PixelBuffers];
+         int  m_next;
+
+         QThread       m_thread;
+         MovieEncoder* m_encoder;
+         QSemaphore    m_slots;
+         unsigned m_captured;
+         unsigned m_dropped;
+         bool m_finishing;
+   };
+
+} // end namespace IQmol
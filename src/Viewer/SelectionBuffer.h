@@ -0,0 +1,89 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2022 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Layer/GLObjectLayer.h"
+#include <QOpenGLContext>
+#include <QPointer>
+#include <QRect>
+#include <vector>
+
+
+class QOpenGLFramebufferObject;
+
+namespace IQmol {
+
+   /// Offscreen buffer used for picking.  Each object is drawn flat-shaded
+   /// with its index (plus one) encoded in the RGB channels, so a pick
+   /// reduces to reading back the pixels under the cursor or selection
+   /// rectangle.  The ID pass is only redrawn when the camera, the viewport,
+   /// the object list, the Layer tree or the placement, shape or mesh of an
+   /// object has changed, or after invalidate() has been called, so repeated
+   /// picks of a static scene are cheap.
+   class SelectionBuffer {
+
+      public:
+         SelectionBuffer();
+         ~SelectionBuffer();
+
+         /// Forces the ID pass to be redrawn on the next update(), for
+         /// changes the buffer cannot detect itself.
+         void invalidate() { m_stale = true; }
+
+         /// Redraws the ID pass if required.  The modelview and projection
+         /// matrices must be loaded and the GL context current.  The size is
+         /// in device pixels and the default framebuffer is rebound on
+         /// completion.  Returns false if no framebuffer is available.
+         bool update(GLObjectList const& objects, QSize const& size,
+            GLuint defaultFramebuffer);
+
+         /// Returns the index of the object drawn closest to the given pixel
+         /// within the region, or -1 if there is none.
+         int pick(QPoint const& center, QSize const& region, GLuint defaultFramebuffer);
+
+         /// Returns the indices of all the objects visible in the rectangle.
+         QList<int> pick(QRect const& rect, GLuint defaultFramebuffer);
+
+      private:
+         bool initProgram();
+         static void signature(GLObjectList const&, std::vector<double>&);
+         QRect readPixels(QRect const& rect, GLuint defaultFramebuffer);
+         int id(int const x, int const y) const;
+
+         QPointer<QOpenGLContext> m_context;
+         QOpenGLFramebufferObject* m_buffer;
+         GLuint m_program;
+         GLint  m_idLocation;
+         bool   m_initialized;
+         bool   m_stale;
+
+         GLObjectList m_objects;
+         GLdouble m_modelview[16];
+         GLdouble m_projection[16];
+         std::vector<double> m_signature;
+
+         // The last block of pixels read, in buffer coordinates
+         QRect m_pixelRect;
+         std::vector<GLubyte> m_pixels;
+   };
+
+} // end namespace IQmol
@@ -22,17 +22,17 @@
 ********************************************************************************/
 
 #include <QStringList>
-#include <QProcess>
 #include <QTimer>
 #include <QSize>
 
 
 ///  Manages the saving of snapshots, writing them to file and creating movies
-///  if requested.
+///  if requested.  Movie frames are streamed to ffmpeg by a MovieRecorder.
 
 namespace IQmol {
 
    class Viewer;
+   class MovieRecorder;
 
    class Snapshot : public QObject {
 
@@ -66,12 +66,9 @@ namespace IQmol {
          void stopRecord();
 
       private Q_SLOTS:
-         void movieError(QProcess::ProcessError);
-         void movieFinished(int, QProcess::ExitStatus);
+         void recordingFinished(bool ok, QString const& errors);
 
       private:
-         void removeImageFiles(QString const& msg);
-
          // Deprecate
          //void writefile(int format, int sort, int options, int nbcol,
          //      const char *filename, const char *extension);
@@ -86,9 +83,10 @@ namespace IQmol {
          int    m_antialias;
          int    m_dpi;
 
-         QStringList m_fileNames;
-         QProcess*   m_movieProcess;
-         QTimer      m_recordTimer;
+         bool   m_lossless;
+
+         MovieRecorder* m_recorder;
+         QTimer         m_recordTimer;
 
          QString m_fileBaseName; 
          QString m_fileExtension;
@@ -60,7 +60,7 @@ class SnapshotVideoDialog : public QDialog {
 
       QSize size() const { return m_size; }
       int framerate() const { return m_framerate; }
-      bool usePNG() const { return m_usePng; }
+      bool lossless() const { return m_lossless; }
       bool continuousRecording() const { return m_continuousRecording; }
 
    private Q_SLOTS:
@@ -73,7 +73,7 @@ class SnapshotVideoDialog : public QDialog {
 
       QSize m_size;
       int   m_framerate;
-      bool  m_usePng;
+      bool  m_lossless;
       bool  m_continuousRecording;
 };
 
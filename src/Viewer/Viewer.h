@@ -31,11 +31,15 @@
 #include "BuildMoleculeFragmentHandler.h"
 #include "BuildFunctionalGroupHandler.h"
 #include "Cursors.h"
+#include "ImpostorRenderer.h"
+#include "LabelRenderer.h"
+#include "LevelOfDetail.h"
 #include "ManipulateHandler.h"
 #include "ReindexAtomsHandler.h"
 #include "ManipulateSelectionHandler.h"
 #include "Preferences.h"
 #include "SelectHandler.h"
+#include "SelectionBuffer.h"
 #include "Snapshot.h"
 
 #include "QGLViewer/qglviewer.h"
@@ -96,7 +100,10 @@ namespace IQmol {
          void editShaders();
          void editCamera();
 
-         void saveImage(QString const& filename, QSize const& size, int const dpi, int const antialias);
+         /// Returns false if the image could not be rendered or written.
+         bool saveImage(QString const& filename, QSize const& size, int const dpi, int const antialias);
+         /// Draws the scene into the framebuffer, which is left unbound.
+         void renderOffscreen(QOpenGLFramebufferObject&);
          void savePovRay(QString const& filename);
 
       Q_SIGNALS:
@@ -145,6 +152,11 @@ namespace IQmol {
          //void renderText(double const x, double const y, double const z, 
          //   const QString& str, const QFont & font = QFont());
 
+      private Q_SLOTS:
+         // Forces the selection buffer to be redrawn before the next pick
+         // and the labels to be rebuilt before the next frame
+         void sceneChanged();
+
       protected:
          void dropEvent(QDropEvent*);
          void dragEnterEvent(QDragEnterEvent*);
@@ -177,10 +189,10 @@ namespace IQmol {
          void displayGeometricParameter(GLObjectList const& selection);
          void displayMullikenDecomposition(GLObjectList const& selection);
          void drawWithNames(); 
-         void renderSelectionBuffer(); 
          void generatePovRay(QString const& filename);
 
          void drawSelectionRectangle(QRect const& rect);
+         void beginSelection(QPoint const&);
          void endSelection(QPoint const&);
          void postSelection(QPoint const&);
          void addToSelection(Layer::GLObject*);
@@ -189,9 +201,6 @@ namespace IQmol {
          void toggleSelection(int const id);
          void setHandler(Viewer::Mode const);
 
-         void resizeSelectionBuffer(QSize const& size);
-         void makeSelection(QPoint const&);
-
          // Event handlers
          void mousePressEvent(QMouseEvent *e);
          void mouseMoveEvent(QMouseEvent *e);
@@ -244,12 +253,14 @@ namespace IQmol {
          bool m_shadersInit;
 
          ShaderLibrary*  m_shaderLibrary;
+         ImpostorRenderer m_impostorRenderer;
+         LevelOfDetail    m_levelOfDetail;
          ShaderDialog*   m_shaderDialog;
          CameraDialog*   m_cameraDialog;
          QOpenGLContext* m_context;
 
-         QOpenGLFramebufferObject* m_selectionBuffer;
-void testSelectionRender();
+         SelectionBuffer m_selectionBuffer;
+         LabelRenderer   m_labelRenderer;
     };
 
 } // end namespace IQmol
@@ -50,6 +50,7 @@ namespace IQmol {
       Q_OBJECT
 
       friend class Viewer;
+      friend class BatchRunner;
 
       public:
          ViewerModel(QWidget* parent = 0);